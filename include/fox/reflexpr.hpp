@@ -12,7 +12,9 @@
 #pragma once
 
 #include <array>
+#include <cstdint>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <unordered_map>
 #include <typeindex>
@@ -384,6 +386,235 @@ namespace fox::reflexpr
 	{
 		return std::get<I>(fox::reflexpr::tie(obj));
 	}
+
+	namespace details
+	{
+		// Fingerprints are built by folding a flat stream of 64-bit words with FNV-1a. Every word is
+		// consumed as little-endian bytes, so the folding itself does not depend on the host. Byte order
+		// is part of the layout a reader sees though, so the native one is folded into the top-level seed.
+		// Member offsets cannot be observed in constant expressions, so they are recomputed from the
+		// sizes and alignments of the members the same way mainstream ABIs lay out aggregates.
+		enum class schema_kind : std::uint64_t
+		{
+			boolean,
+			signed_integral,
+			unsigned_integral,
+			floating_point,
+			enumeration,
+			pointer,
+			member_pointer,
+			null_pointer,
+			reference,
+			array,
+			aggregate,
+			opaque
+		};
+
+		inline constexpr std::uint64_t schema_hash_basis = 0xcbf29ce484222325ull;
+		inline constexpr std::uint64_t schema_hash_prime = 0x00000100000001b3ull;
+
+		constexpr std::uint64_t schema_hash_combine(std::uint64_t seed, std::uint64_t value) noexcept
+		{
+			for (std::size_t i = 0; i < sizeof(value); ++i)
+			{
+				seed ^= (value >> (i * 8)) & 0xffull;
+				seed *= schema_hash_prime;
+			}
+
+			return seed;
+		}
+
+		constexpr std::uint64_t schema_hash_combine(std::uint64_t seed, schema_kind kind) noexcept
+		{
+			return schema_hash_combine(seed, static_cast<std::uint64_t>(kind));
+		}
+
+		constexpr std::uint64_t schema_hash_combine(std::uint64_t seed, std::endian order) noexcept
+		{
+			return schema_hash_combine(seed, static_cast<std::uint64_t>(order));
+		}
+
+		inline constexpr std::uint64_t schema_hash_native_basis = schema_hash_combine(schema_hash_basis, std::endian::native);
+
+		// Types that cannot be decomposed are identified by their spelling. The signature string is
+		// compiler specific, so fingerprints of such types only match between binaries of the same toolchain.
+		template<class T>
+		constexpr std::uint64_t schema_hash_name() noexcept
+		{
+#if defined(_MSC_VER) && !defined(__clang__)
+			const std::string_view name = __FUNCSIG__;
+#else
+			const std::string_view name = __PRETTY_FUNCTION__;
+#endif
+			std::uint64_t seed = schema_hash_basis;
+			for (const char c : name)
+				seed = schema_hash_combine(seed, static_cast<std::uint64_t>(static_cast<unsigned char>(c)));
+
+			return seed;
+		}
+
+		// Reference members occupy the storage of a pointer, not of the referenced object.
+		template<class T>
+		struct schema_storage
+		{
+			static constexpr std::size_t size = std::is_reference_v<T> ? sizeof(void*) : sizeof(T);
+			static constexpr std::size_t alignment = std::is_reference_v<T> ? alignof(void*) : alignof(T);
+		};
+
+		template<class T>
+		concept schema_decomposable =
+			std::is_class_v<T> &&
+			std::is_aggregate_v<T> &&
+			(::fox::reflexpr::tuple_size_v<T> <= FOX_REFLEXPR_NUM_SUPPORTED_MEMBERS);
+
+		template<class T>
+		constexpr std::uint64_t schema_hash_of(std::uint64_t seed = schema_hash_basis) noexcept;
+
+		// Offsets of all members followed by the size of the aggregate, assuming natural alignment of every member.
+		template<class T, std::size_t... Is>
+		constexpr std::array<std::size_t, sizeof...(Is) + 1> schema_offsets(std::index_sequence<Is...>) noexcept
+		{
+			std::array<std::size_t, sizeof...(Is) + 1> offsets{};
+			std::size_t offset = 0;
+
+			([&]
+			{
+				using member = ::fox::reflexpr::tuple_element_t<Is, T>;
+				constexpr std::size_t alignment = schema_storage<member>::alignment;
+
+				offset = (offset + alignment - 1) / alignment * alignment;
+				offsets[Is] = offset;
+				offset += schema_storage<member>::size;
+			}(), ...);
+
+			offsets[sizeof...(Is)] = (offset + alignof(T) - 1) / alignof(T) * alignof(T);
+			return offsets;
+		}
+
+		template<class T, std::size_t... Is>
+		constexpr std::uint64_t schema_hash_of_members(std::uint64_t seed, std::index_sequence<Is...> sequence) noexcept
+		{
+			constexpr auto offsets = schema_offsets<T>(sequence);
+
+			// Empty aggregates occupy a byte despite having no members.
+			static_assert(sizeof...(Is) == 0 || offsets[sizeof...(Is)] == sizeof(T),
+				"Aggregate size does not match natural member layout (e.g. #pragma pack, alignas or [[no_unique_address]] members)");
+
+			([&]
+			{
+				seed = schema_hash_combine(seed, static_cast<std::uint64_t>(offsets[Is]));
+				seed = schema_hash_combine(seed, schema_hash_of<::fox::reflexpr::tuple_element_t<Is, T>>());
+			}(), ...);
+
+			return seed;
+		}
+
+		template<class T>
+		constexpr std::uint64_t schema_hash_of(std::uint64_t seed) noexcept
+		{
+			if constexpr (std::is_reference_v<T>)
+			{
+				// The referenced type is not visited, a self-referencing aggregate would never terminate.
+				seed = schema_hash_combine(seed, schema_kind::reference);
+				seed = schema_hash_combine(seed, static_cast<std::uint64_t>(schema_storage<T>::size));
+				seed = schema_hash_combine(seed, static_cast<std::uint64_t>(schema_storage<T>::alignment));
+			}
+			else
+			{
+				using type = std::remove_cv_t<T>;
+
+				seed = schema_hash_combine(seed, static_cast<std::uint64_t>(sizeof(type)));
+				seed = schema_hash_combine(seed, static_cast<std::uint64_t>(alignof(type)));
+
+				if constexpr (std::is_same_v<type, bool>)
+				{
+					seed = schema_hash_combine(seed, schema_kind::boolean);
+				}
+				else if constexpr (std::is_integral_v<type>)
+				{
+					seed = schema_hash_combine(seed, std::is_signed_v<type> ? schema_kind::signed_integral : schema_kind::unsigned_integral);
+				}
+				else if constexpr (std::is_floating_point_v<type>)
+				{
+					seed = schema_hash_combine(seed, schema_kind::floating_point);
+				}
+				else if constexpr (std::is_enum_v<type>)
+				{
+					seed = schema_hash_combine(seed, schema_kind::enumeration);
+					seed = schema_hash_combine(seed, schema_hash_of<std::underlying_type_t<type>>());
+				}
+				else if constexpr (std::is_pointer_v<type>)
+				{
+					// Same as with references, the pointee is not visited.
+					seed = schema_hash_combine(seed, schema_kind::pointer);
+				}
+				else if constexpr (std::is_member_pointer_v<type>)
+				{
+					seed = schema_hash_combine(seed, schema_kind::member_pointer);
+				}
+				else if constexpr (std::is_null_pointer_v<type>)
+				{
+					seed = schema_hash_combine(seed, schema_kind::null_pointer);
+				}
+				else if constexpr (std::is_array_v<type>)
+				{
+					seed = schema_hash_combine(seed, schema_kind::array);
+					seed = schema_hash_combine(seed, static_cast<std::uint64_t>(std::extent_v<type>));
+					seed = schema_hash_combine(seed, schema_hash_of<std::remove_extent_t<type>>());
+				}
+				else if constexpr (schema_decomposable<type>)
+				{
+					constexpr std::size_t size = ::fox::reflexpr::tuple_size_v<type>;
+					seed = schema_hash_combine(seed, schema_kind::aggregate);
+					seed = schema_hash_combine(seed, static_cast<std::uint64_t>(size));
+					seed = schema_hash_of_members<type>(seed, std::make_index_sequence<size>{});
+				}
+				else
+				{
+					seed = schema_hash_combine(seed, schema_kind::opaque);
+					seed = schema_hash_combine(seed, schema_hash_name<type>());
+				}
+			}
+
+			return seed;
+		}
+	}
+
+	/**
+	 * \brief		Provides a 64-bit fingerprint of the aggregate's layout as a compile-time constant expression.
+	 *				See the "Layout fingerprints" section of README.md for its limitations.
+	 * \tparam T	Aggregate type
+	 */
+	template<aggregate T>
+	struct schema_hash :
+		std::integral_constant<std::uint64_t, ::fox::reflexpr::details::schema_hash_of<std::remove_cvref_t<T>>(::fox::reflexpr::details::schema_hash_native_basis)>
+	{
+		static_assert(tuple_size_v<T> <= FOX_REFLEXPR_NUM_SUPPORTED_MEMBERS, "Unsupported number of struct members");
+	};
+
+	/**
+	 * \brief		Helper variable template. Provides a 64-bit fingerprint of the aggregate's layout as a compile-time constant expression.
+	 * \tparam T	Aggregate type
+	 */
+	template<aggregate T>
+	static constexpr std::uint64_t schema_hash_v = schema_hash<T>::value;
+
+	/**
+	 * \brief		Checks if two aggregates have the same layout fingerprint.
+	 * \tparam T	Aggregate type
+	 * \tparam U	Aggregate type
+	 */
+	template<aggregate T, aggregate U>
+	struct layout_compatible :
+		std::bool_constant<schema_hash<T>::value == schema_hash<U>::value> {};
+
+	/**
+	 * \brief		Helper variable template. Checks if two aggregates have the same layout fingerprint.
+	 * \tparam T	Aggregate type
+	 * \tparam U	Aggregate type
+	 */
+	template<aggregate T, aggregate U>
+	static constexpr bool layout_compatible_v = layout_compatible<T, U>::value;
 }
 
 #endif
\ No newline at end of file
@@ -10,6 +10,20 @@ struct my_aggregate
 	int& d;
 };
 
+struct vec3
+{
+	float x;
+	float y;
+	float z;
+};
+
+struct point
+{
+	float a;
+	float b;
+	float c;
+};
+
 int main()
 {
 	int d = 5;
@@ -43,5 +57,11 @@ int main()
 	// Tuple Nth type
 	static_assert(std::is_same_v<fox::reflexpr::tuple_element_t<3, my_aggregate>, int&>);
 
+	// Layout fingerprint - fox::reflexpr::schema_hash_v<aggregate_type>
+	std::cout << std::hex << fox::reflexpr::schema_hash_v<vec3> << std::dec << '\n';
+
+	// Layout compatibility - fox::reflexpr::layout_compatible_v<aggregate_type, aggregate_type>
+	static_assert(fox::reflexpr::layout_compatible_v<vec3, point>);
+
 	return 0;
 }
\ No newline at end of file
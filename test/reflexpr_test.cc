@@ -6,6 +6,10 @@
 #include <concepts>
 #include <array>
 #include <utility>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <bit>
 
 namespace fox::reflexpr
 {
@@ -237,4 +241,83 @@ namespace fox::reflexpr
 
 	REGISTER_TYPED_TEST_SUITE_P(reflexpr_test, aggregate_concept, for_each, tuple_size, tuple_element, get, make_tuple, tie);
 	INSTANTIATE_TYPED_TEST_SUITE_P(fundamental, reflexpr_test, types);
-}
\ No newline at end of file
+
+	namespace schema_test
+	{
+		struct vec3 { float x; float y; float z; };
+		struct point { float a; float b; float c; };
+		struct ivec3 { int x; int y; int z; };
+
+		struct particle { vec3 position; vec3 velocity; std::uint32_t id; };
+		struct particle_other { point position; point velocity; std::uint32_t id; };
+		struct particle_swapped { std::uint32_t id; vec3 position; vec3 velocity; };
+		struct particle_nested_int { ivec3 position; vec3 velocity; std::uint32_t id; };
+
+		enum class color : std::uint8_t { red, green };
+		struct with_enum { color c; std::uint8_t v; };
+		struct with_bytes { std::uint8_t c; std::uint8_t v; };
+
+		struct with_reference { int& r; int v; };
+		struct with_pointer { int* p; int v; };
+
+		struct with_string { std::string s; };
+		struct with_vector { std::vector<char> s; };
+
+		struct byte_pair { std::uint8_t a; std::uint8_t b; };
+		struct alignas(2) aligned_byte_pair { std::uint8_t a; std::uint8_t b; };
+		struct loose { std::uint8_t a; byte_pair p; std::uint16_t b; };
+		struct tight { std::uint8_t a; aligned_byte_pair p; std::uint16_t b; };
+
+		struct alignas(16) aligned_vec3 { float x; float y; float z; };
+
+		struct empty {};
+		struct other_empty {};
+		struct with_empty { empty e; int v; };
+		struct with_byte { std::uint8_t e; int v; };
+	}
+
+	TEST(reflexpr_schema_test, schema_hash)
+	{
+		using namespace schema_test;
+
+		static_assert(schema_hash_v<vec3> == schema_hash<vec3>::value);
+		static_assert(schema_hash_v<vec3> == schema_hash_v<const vec3>);
+		static_assert(schema_hash_v<vec3> != schema_hash_v<ivec3>);
+
+		static_assert(schema_hash_v<vec3> == details::schema_hash_of<vec3>(details::schema_hash_native_basis));
+		static_assert(schema_hash_v<vec3> != details::schema_hash_of<vec3>());
+		static_assert(
+			details::schema_hash_of<vec3>(details::schema_hash_combine(details::schema_hash_basis, std::endian::little)) !=
+			details::schema_hash_of<vec3>(details::schema_hash_combine(details::schema_hash_basis, std::endian::big)));
+
+		static_assert(schema_hash_v<particle> != schema_hash_v<particle_swapped>);
+		static_assert(schema_hash_v<particle> != schema_hash_v<particle_nested_int>);
+
+		static_assert(schema_hash_v<with_enum> != schema_hash_v<with_bytes>);
+		static_assert(schema_hash_v<int[4]> != schema_hash_v<int[3]>);
+		static_assert(schema_hash_v<with_reference> != schema_hash_v<with_pointer>);
+		static_assert(schema_hash_v<with_string> != schema_hash_v<with_vector>);
+
+		static_assert(sizeof(loose) == sizeof(tight));
+		static_assert(schema_hash_v<loose> != schema_hash_v<tight>);
+		static_assert(schema_hash_v<vec3> != schema_hash_v<aligned_vec3>);
+
+		static_assert(schema_hash_v<empty> == schema_hash_v<other_empty>);
+		static_assert(schema_hash_v<with_empty> != schema_hash_v<with_byte>);
+	}
+
+	TEST(reflexpr_schema_test, layout_compatible)
+	{
+		using namespace schema_test;
+
+		static_assert(layout_compatible_v<vec3, point>);
+		static_assert(layout_compatible_v<particle, particle_other>);
+		static_assert(layout_compatible<particle, particle_other>::value);
+
+		static_assert(!layout_compatible_v<vec3, ivec3>);
+		static_assert(!layout_compatible_v<particle, particle_swapped>);
+		static_assert(layout_compatible_v<vec3[2], point[2]>);
+		static_assert(!layout_compatible_v<vec3[2], point[3]>);
+		static_assert(!layout_compatible_v<loose, tight>);
+	}
+}